@@ -63,6 +63,49 @@ bool stusb4500_read_register(const stusb4500_t* const dev, const uint8_t reg, ui
  */
 bool stusb4500_write_register(const stusb4500_t* const dev, const uint8_t reg, const uint8_t value);
 
+/**
+ * @brief Subscribe to state changes and program ALERT_STATUS_1_MASK to match.
+ *
+ * Only the alert sources backing the requested conditions are unmasked, so the
+ * ALERT pin fires only for relevant changes. Transitions are coalesced: the
+ * first change is reported immediately, later ones within @p interval_ms are
+ * accumulated and reported together by the first poll after the interval.
+ *
+ * @param dev Pointer to the STUSB4500 handle.
+ * @param events Bitmask of STUSB4500_EVT_* conditions.
+ * @param interval_ms Minimum time between callbacks (0 disables coalescing).
+ * @param callback Function invoked on changes.
+ * @param ctx User context forwarded to the callback.
+ * @return true on success.
+ */
+bool stusb4500_subscribe(stusb4500_t* const dev, const uint32_t events, const uint32_t interval_ms,
+                         const stusb4500_event_cb_t callback, void* const ctx);
+
+/**
+ * @brief Drop the subscription and restore the alert mask it replaced.
+ *
+ * The subscription is kept if the mask cannot be restored, so the call can be retried.
+ *
+ * @param dev Pointer to the STUSB4500 handle.
+ * @return true on success.
+ */
+bool stusb4500_unsubscribe(stusb4500_t* const dev);
+
+/**
+ * @brief Sample the subscribed conditions and dispatch coalesced changes.
+ *
+ * Call from the ALERT handler task. Transitions held back by the coalescing
+ * window are not re-signalled on ALERT, so when @p next_poll_ms is non-zero
+ * poll again after that many milliseconds to deliver them.
+ *
+ * @param dev Pointer to the STUSB4500 handle.
+ * @param now_ms Monotonic timestamp in milliseconds (wrap-around safe).
+ * @param next_poll_ms Optional; receives the time until held-back changes are
+ *                     due, or 0 when nothing is pending.
+ * @return true on success.
+ */
+bool stusb4500_poll_events(stusb4500_t* const dev, const uint32_t now_ms, uint32_t* const next_poll_ms);
+
 #ifdef __cplusplus
 }
 #endif
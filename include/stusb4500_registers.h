@@ -359,6 +359,17 @@
 #define STUSB4500_PDO_BYTE_SHIFT                0
 #define STUSB4500_PDO_BYTE_MASK                 (0xFFU << STUSB4500_PDO_BYTE_SHIFT)
 
+/* Sink PDO word (DPM_SNK_PDOx_0..3, little-endian) */
+/** Operational current [9:0] in 10mA units */
+#define STUSB4500_SNK_PDO_CURRENT_SHIFT         0
+#define STUSB4500_SNK_PDO_CURRENT_MASK          (0x3FFUL << STUSB4500_SNK_PDO_CURRENT_SHIFT)
+/** Voltage [19:10] in 50mV units */
+#define STUSB4500_SNK_PDO_VOLTAGE_SHIFT         10
+#define STUSB4500_SNK_PDO_VOLTAGE_MASK          (0x3FFUL << STUSB4500_SNK_PDO_VOLTAGE_SHIFT)
+/** Supply type [31:30] */
+#define STUSB4500_SNK_PDO_TYPE_SHIFT            30
+#define STUSB4500_SNK_PDO_TYPE_MASK             (0x3UL << STUSB4500_SNK_PDO_TYPE_SHIFT)
+
 /* RDO_REG_STATUS Bitfields */
 /** RDO status byte [7:0] */
 #define STUSB4500_RDO_BYTE_SHIFT                0
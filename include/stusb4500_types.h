@@ -79,6 +79,19 @@ typedef enum {
     STUSB4500_DISCONNECT_VBUS_HIGH = 2  ///< High threshold
 } stusb4500_disconnect_threshold_t;
 
+/** @brief Subscribable state conditions (bitmask) */
+typedef enum {
+    STUSB4500_EVT_ATTACH           = (1U << 0), ///< Attach state (PORT_STATUS_1)
+    STUSB4500_EVT_VBUS_READY       = (1U << 1), ///< VBUS ready (TYPEC_MONITORING_STATUS_1)
+    STUSB4500_EVT_VBUS_HIGH        = (1U << 2), ///< VBUS above OVP window (TYPEC_MONITORING_STATUS_0)
+    STUSB4500_EVT_VBUS_LOW         = (1U << 3), ///< VBUS below UVP window (TYPEC_MONITORING_STATUS_0)
+    STUSB4500_EVT_CC_HW_FAULT      = (1U << 4), ///< CC hardware fault alert (ALERT_STATUS_1, edge only)
+    STUSB4500_EVT_VPU_OVP_FAULT    = (1U << 5), ///< VPU over-voltage fault (CC_HW_FAULT_STATUS_1)
+    STUSB4500_EVT_VBUS_DISCH_FAULT = (1U << 6), ///< VBUS discharge fault (CC_HW_FAULT_STATUS_1)
+} stusb4500_event_t;
+
+#define STUSB4500_EVT_ALL                0x7FU /** @brief All subscribable conditions */
+
 /** @} */ // end STUSB4500_Enums
 
 /** @defgroup STUSB4500_Config Device Configuration Structures
@@ -143,6 +156,30 @@ typedef struct
     bool protocol_fault_alert;  ///< Issue with the protocol
 } stusb4500_interrupt_status_t;
 
+/**
+ * @brief Event subscription callback.
+ * @param changed Conditions that transitioned since the last callback (STUSB4500_EVT_*),
+ *                including transitions that reverted before they could be sampled.
+ * @param state Current level of the subscribed level conditions (STUSB4500_EVT_*).
+ *              STUSB4500_EVT_CC_HW_FAULT is a latched alert and only ever appears in @p changed.
+ * @param ctx User context passed to stusb4500_subscribe().
+ */
+typedef void (*stusb4500_event_cb_t)(const uint32_t changed, const uint32_t state, void* const ctx);
+
+/** Event subscription and coalescing state (owned by the driver) */
+typedef struct 
+{
+    stusb4500_event_cb_t callback;      ///< Change callback, NULL when unsubscribed
+    void*                ctx;           ///< User context for the callback
+    uint32_t             mask;          ///< Subscribed conditions
+    uint32_t             interval_ms;   ///< Minimum time between callbacks
+    uint32_t             state;         ///< Last observed condition levels
+    uint32_t             pending;       ///< Transitions not yet reported
+    uint32_t             window_start;  ///< Timestamp of the last callback
+    bool                 window_open;   ///< Coalescing window active
+    uint8_t              saved_alert_mask; ///< Subscription-owned ALERT_STATUS_1_MASK bits before subscribing
+} stusb4500_events_t;
+
 /** @} */ // end STUSB4500_Status
 
 typedef struct 
@@ -156,6 +193,7 @@ typedef struct
 {
     stusb4500_hal_t hal;
     uint8_t address;
+    stusb4500_events_t events;
 } stusb4500_t;
 
 #ifdef __cplusplus
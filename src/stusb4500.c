@@ -19,37 +19,167 @@
 // =============================================
 
 /**
- * @brief Convert millivolts to register value (50mV steps).
+ * @brief Convert millivolts to the PDO voltage field (absolute, 50mV steps).
+ *
+ * Out-of-range inputs are clamped; in-range inputs truncate down to the step.
+ *
  * @param mV Voltage in millivolts (5000-20000).
- * @return uint16_t Register value.
+ * @return uint16_t Field value (100-400).
  */
 static uint16_t _mv_to_reg(uint16_t mV) {
     if (mV < STUSB4500_MIN_VOLTAGE_MV) mV = STUSB4500_MIN_VOLTAGE_MV;
     if (mV > STUSB4500_MAX_VOLTAGE_MV) mV = STUSB4500_MAX_VOLTAGE_MV;
-    return (mV / 50) - 100;
+    return mV / 50;
 }
 
 /**
- * @brief Convert milliamps to register value (10mA steps).
+ * @brief Convert milliamps to the PDO current field (absolute, 10mA steps).
+ *
+ * Out-of-range inputs are clamped; in-range inputs truncate down to the step.
+ *
  * @param mA Current in milliamps (500-5000).
- * @return uint16_t Register value.
+ * @return uint16_t Field value (50-500).
  */
 static uint16_t _ma_to_reg(uint16_t mA) {
     if (mA < STUSB4500_MIN_CURRENT_MA) mA = STUSB4500_MIN_CURRENT_MA;
     if (mA > STUSB4500_MAX_CURRENT_MA) mA = STUSB4500_MAX_CURRENT_MA;
-    return (mA / 10) - 50;
+    return mA / 10;
+}
+
+/**
+ * @brief Pack a sink PDO word (fixed-supply field layout).
+ * @param pdo Sink PDO configuration.
+ * @return uint32_t PDO word as stored in DPM_SNK_PDOx_0..3.
+ */
+static uint32_t _pack_sink_pdo(const stusb4500_sink_pdo_t* const pdo) {
+    return (((uint32_t)pdo->type << STUSB4500_SNK_PDO_TYPE_SHIFT) & STUSB4500_SNK_PDO_TYPE_MASK)
+         | (((uint32_t)_mv_to_reg(pdo->voltage_mv) << STUSB4500_SNK_PDO_VOLTAGE_SHIFT) & STUSB4500_SNK_PDO_VOLTAGE_MASK)
+         | (((uint32_t)_ma_to_reg(pdo->current_ma) << STUSB4500_SNK_PDO_CURRENT_SHIFT) & STUSB4500_SNK_PDO_CURRENT_MASK);
+}
+
+/** @brief ALERT_STATUS_1_MASK bits owned by the event subscription. */
+#define STUSB4500_EVT_ALERT_BITS (STUSB4500_PORT_STATUS_AL_M_MASK | STUSB4500_TYPEC_MON_STATUS_M_MASK | STUSB4500_CC_FAULT_AL_M_MASK)
+
+/** @brief Conditions reported as edges only; they never appear in the callback state. */
+#define STUSB4500_EVT_EDGE_ONLY  (STUSB4500_EVT_CC_HW_FAULT)
+
+/** @brief First and last register of the event burst read. */
+#define STUSB4500_EVT_BURST_FIRST STUSB4500_REG_ALERT_STATUS_1
+#define STUSB4500_EVT_BURST_LAST  STUSB4500_REG_CC_HW_FAULT_STATUS_1
+
+/**
+ * @brief Map subscribed conditions to the alert mask bits that must be cleared.
+ * @param events Bitmask of STUSB4500_EVT_* conditions.
+ * @return uint8_t ALERT_STATUS_1_MASK bits backing the conditions.
+ */
+static uint8_t _events_to_alert_bits(const uint32_t events) {
+    uint8_t bits = 0;
+    if (events & STUSB4500_EVT_ATTACH) 
+        bits |= STUSB4500_PORT_STATUS_AL_M_MASK;
+    if (events & (STUSB4500_EVT_VBUS_READY | STUSB4500_EVT_VBUS_HIGH | STUSB4500_EVT_VBUS_LOW)) 
+        bits |= STUSB4500_TYPEC_MON_STATUS_M_MASK;
+    if (events & (STUSB4500_EVT_CC_HW_FAULT | STUSB4500_EVT_VPU_OVP_FAULT | STUSB4500_EVT_VBUS_DISCH_FAULT)) 
+        bits |= STUSB4500_CC_FAULT_AL_M_MASK;
+    return bits;
+}
+
+/**
+ * @brief Fetch one register from the event burst buffer.
+ * @param regs Burst buffer starting at STUSB4500_EVT_BURST_FIRST.
+ * @param reg Register address within the burst.
+ * @return uint8_t Register value.
+ */
+static inline uint8_t _burst_reg(const uint8_t* const regs, const uint8_t reg) {
+    return regs[reg - STUSB4500_EVT_BURST_FIRST];
+}
+
+/**
+ * @brief Decode the event registers ALERT_STATUS_1 through CC_HW_FAULT_STATUS_1.
+ * @param regs Register values starting at STUSB4500_EVT_BURST_FIRST.
+ * @param state Receives the STUSB4500_EVT_* levels (never edge-only conditions).
+ * @param trans Receives the STUSB4500_EVT_* conditions with a latched transition.
+ */
+static void _decode_event_regs(const uint8_t* const regs, uint32_t* const state, uint32_t* const trans) {
+    const uint8_t alert   = _burst_reg(regs, STUSB4500_REG_ALERT_STATUS_1);
+    const uint8_t port_0  = _burst_reg(regs, STUSB4500_REG_PORT_STATUS_0);
+    const uint8_t port_1  = _burst_reg(regs, STUSB4500_REG_PORT_STATUS_1);
+    const uint8_t mon_0   = _burst_reg(regs, STUSB4500_REG_TYPEC_MONITORING_STATUS_0);
+    const uint8_t mon_1   = _burst_reg(regs, STUSB4500_REG_TYPEC_MONITORING_STATUS_1);
+    const uint8_t fault_0 = _burst_reg(regs, STUSB4500_REG_CC_HW_FAULT_STATUS_0);
+    const uint8_t fault_1 = _burst_reg(regs, STUSB4500_REG_CC_HW_FAULT_STATUS_1);
+
+    uint32_t s = 0;
+    if (port_1 & STUSB4500_ATTACH_STATE_MASK)         s |= STUSB4500_EVT_ATTACH;
+    if (mon_1 & STUSB4500_VBUS_READY_MASK)            s |= STUSB4500_EVT_VBUS_READY;
+    if (mon_0 & STUSB4500_VBUS_HIGH_MASK)             s |= STUSB4500_EVT_VBUS_HIGH;
+    if (mon_0 & STUSB4500_VBUS_LOW_MASK)              s |= STUSB4500_EVT_VBUS_LOW;
+    if (fault_1 & STUSB4500_VPU_OVP_FAULT_MASK)       s |= STUSB4500_EVT_VPU_OVP_FAULT;
+    if (fault_1 & STUSB4500_VBUS_DISCH_FAULT_MASK)    s |= STUSB4500_EVT_VBUS_DISCH_FAULT;
+
+    uint32_t t = 0;
+    if (port_0 & STUSB4500_ATTACH_TRANS_MASK)         t |= STUSB4500_EVT_ATTACH;
+    if (mon_0 & STUSB4500_VBUS_READY_TRANS_MASK)      t |= STUSB4500_EVT_VBUS_READY;
+    if (fault_0 & STUSB4500_VPU_OVP_TRANS_MASK)       t |= STUSB4500_EVT_VPU_OVP_FAULT;
+    if (alert & STUSB4500_CC_HW_FAULT_AL_MASK)        t |= STUSB4500_EVT_CC_HW_FAULT;
+
+    *state = s;
+    *trans = t;
+}
+
+/**
+ * @brief Sample every subscribable condition with a single burst read.
+ *
+ * ALERT_STATUS_1 through CC_HW_FAULT_STATUS_1 are contiguous, so one
+ * transaction also acknowledges the latched alerts and transition flags.
+ * Those latches are returned in @p trans so that a change which reverted
+ * between two reads is not lost.
+ *
+ * @param dev Pointer to the STUSB4500 handle.
+ * @param state Receives the STUSB4500_EVT_* levels (never edge-only conditions).
+ * @param trans Receives the STUSB4500_EVT_* conditions with a latched transition.
+ * @return true on success.
+ */
+static bool _read_event_state(const stusb4500_t* const dev, uint32_t* const state, uint32_t* const trans) {
+    uint8_t regs[STUSB4500_EVT_BURST_LAST - STUSB4500_EVT_BURST_FIRST + 1];
+
+    if (dev->hal.i2c_read(dev->address, STUSB4500_EVT_BURST_FIRST, regs, sizeof(regs)) != 0)
+        return false;
+
+    _decode_event_regs(regs, state, trans);
+    return true;
+}
+
+/**
+ * @brief Replace the subscription-owned bits of ALERT_STATUS_1_MASK.
+ * @param dev Pointer to the STUSB4500 handle.
+ * @param owned New value for the STUSB4500_EVT_ALERT_BITS (a set bit masks the alert).
+ * @param previous Optional; receives the owned bits as they were before the write.
+ * @return true on success.
+ */
+static bool _write_alert_mask(const stusb4500_t* const dev, const uint8_t owned, uint8_t* const previous) {
+    uint8_t mask = 0;
+    if (!stusb4500_read_register(dev, STUSB4500_REG_ALERT_STATUS_1_MASK, &mask))
+        return false;
+
+    if (previous)
+        *previous = mask & STUSB4500_EVT_ALERT_BITS;
+
+    // Leave bits outside the subscription untouched
+    mask = (mask & ~STUSB4500_EVT_ALERT_BITS) | (owned & STUSB4500_EVT_ALERT_BITS);
+    return stusb4500_write_register(dev, STUSB4500_REG_ALERT_STATUS_1_MASK, mask);
 }
 
 
 bool stusb4500_init(stusb4500_t* const handle, const stusb4500_hal_t* const hal, const uint8_t address) 
 {
-    if (!handle || !handle->hal.i2c_write || !handle->hal.i2c_read) 
+    if (!handle || !hal || !hal->i2c_write || !hal->i2c_read) 
     {
         return false;
     }
 
     handle->hal = *hal;
     handle->address = address;
+    memset(&handle->events, 0, sizeof(handle->events));
 
     return true;
 }
@@ -62,28 +192,24 @@ bool stusb4500_set_config(const stusb4500_t* const handle, const stusb4500_confi
         return false;
     }
 
-    bool status = 0;
-    // Write PDO configurations
+    // Write PDO configurations, least significant byte first; stop at the first failure
     for (uint8_t i = 0; i < config->active_pdo_count; i++) {
-        uint8_t reg_voltage = STUSB4500_REG_DPM_SNK_PDO1_0 + (i * 4);
-        uint8_t reg_current = STUSB4500_REG_DPM_SNK_PDO1_2 + (i * 4);
-
-        uint16_t voltage_reg = _mv_to_reg(config->sink_pdos[i].voltage_mv);
-        uint16_t current_reg = _ma_to_reg(config->sink_pdos[i].current_ma);
-        
-        status |= stusb4500_write_register(handle, reg_voltage, (voltage_reg >> 8) & 0xFF);
-        status |= stusb4500_write_register(handle, reg_voltage + 1, voltage_reg & 0xFF);
-        status |= stusb4500_write_register(handle, reg_current, (current_reg >> 8) & 0xFF);
-        status |= stusb4500_write_register(handle, reg_current + 1, current_reg & 0xFF);
+        const uint8_t reg = STUSB4500_REG_DPM_SNK_PDO1_0 + (i * 4);
+        const uint32_t pdo = _pack_sink_pdo(&config->sink_pdos[i]);
+
+        for (uint8_t b = 0; b < 4; b++) {
+            if (!stusb4500_write_register(handle, reg + b, (pdo >> (b * 8)) & STUSB4500_PDO_BYTE_MASK))
+                return false;
+        }
     }
 
-    return status;
+    return true;
 }
 
 bool stusb4500_read_register(const stusb4500_t* const dev, const uint8_t reg, uint8_t* const value)
 {
     if(dev == NULL || value == NULL)
-        return 1;
+        return 0;
 
     return (dev->hal.i2c_read(dev->address, reg, value, 1) == 0);
 }
@@ -95,3 +221,95 @@ bool stusb4500_write_register(const stusb4500_t* const dev, const uint8_t reg, c
 
     return (dev->hal.i2c_write(dev->address, reg, &value, 1) == 0);
 }
+
+bool stusb4500_subscribe(stusb4500_t* const dev, const uint32_t events, const uint32_t interval_ms,
+                         const stusb4500_event_cb_t callback, void* const ctx)
+{
+    if (dev == NULL || callback == NULL || (events & STUSB4500_EVT_ALL) == 0 || (events & ~STUSB4500_EVT_ALL) != 0)
+        return false;
+
+    // Baseline read also acknowledges transitions latched before subscribing
+    uint32_t state = 0;
+    uint32_t trans = 0;
+    uint8_t previous = 0;
+    const uint8_t owned = (uint8_t)(STUSB4500_EVT_ALERT_BITS & ~_events_to_alert_bits(events));
+    if (!_read_event_state(dev, &state, &trans) || !_write_alert_mask(dev, owned, &previous))
+        return false;
+
+    stusb4500_events_t* const ev = &dev->events;
+    // Re-subscribing keeps the mask captured before the first subscription
+    if (ev->callback == NULL)
+        ev->saved_alert_mask = previous;
+    ev->callback = callback;
+    ev->ctx = ctx;
+    ev->mask = events;
+    ev->interval_ms = interval_ms;
+    ev->state = state & events;
+    ev->pending = 0;
+    ev->window_start = 0;
+    ev->window_open = false;
+
+    return true;
+}
+
+bool stusb4500_unsubscribe(stusb4500_t* const dev)
+{
+    if (dev == NULL)
+        return false;
+
+    if (dev->events.callback == NULL)
+        return true;
+
+    // Restore the caller's alert mask; keep the subscription if that fails
+    if (!_write_alert_mask(dev, dev->events.saved_alert_mask, NULL))
+        return false;
+
+    memset(&dev->events, 0, sizeof(dev->events));
+    return true;
+}
+
+bool stusb4500_poll_events(stusb4500_t* const dev, const uint32_t now_ms, uint32_t* const next_poll_ms)
+{
+    if (dev == NULL)
+        return false;
+
+    if (next_poll_ms)
+        *next_poll_ms = 0;
+
+    stusb4500_events_t* const ev = &dev->events;
+    if (ev->callback == NULL)
+        return true;
+
+    uint32_t state = 0;
+    uint32_t trans = 0;
+    if (!_read_event_state(dev, &state, &trans))
+        return false;
+
+    state &= ev->mask;
+    ev->pending |= (state ^ ev->state) | (trans & ev->mask);
+    ev->state = state;
+
+    const uint32_t elapsed = now_ms - ev->window_start;
+    if (ev->window_open && elapsed < ev->interval_ms)
+    {
+        // Held back by the coalescing window; tell the caller when it closes
+        if (next_poll_ms && ev->pending)
+            *next_poll_ms = ev->interval_ms - elapsed;
+        return true;
+    }
+
+    if (ev->pending == 0)
+    {
+        // Quiet for a full interval, so the next change is reported immediately
+        ev->window_open = false;
+        return true;
+    }
+
+    const uint32_t changed = ev->pending;
+    ev->pending = 0;
+    ev->window_start = now_ms;
+    ev->window_open = true;
+    ev->callback(changed, state, ev->ctx);
+
+    return true;
+}
@@ -0,0 +1,14 @@
+/**
+ * @file stusb4500_fuzz.c
+ * @brief libFuzzer entry point for the shared harness.
+ * @version 0.1
+ * @date 2026-10-19
+ */
+
+#include "stusb4500_harness.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    harness_run(data, size);
+    return 0;
+}
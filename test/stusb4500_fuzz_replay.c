@@ -0,0 +1,30 @@
+/**
+ * @file stusb4500_fuzz_replay.c
+ * @brief Corpus replay driver for toolchains without libFuzzer.
+ * @version 0.1
+ * @date 2026-10-19
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++) {
+        FILE* const f = fopen(argv[i], "rb");
+        if (f == NULL) {
+            fprintf(stderr, "cannot open %s\n", argv[i]);
+            return 1;
+        }
+
+        uint8_t buf[4096];
+        const size_t size = fread(buf, 1, sizeof(buf), f);
+        fclose(f);
+        LLVMFuzzerTestOneInput(buf, size);
+    }
+    return 0;
+}
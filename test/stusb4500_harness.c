@@ -0,0 +1,499 @@
+/**
+ * @file stusb4500_harness.c
+ * @brief Fake register-file HAL and model-based property checks for the STUSB4500 driver.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * The driver source is included directly so the static codecs and the event
+ * burst decoder can be exercised alongside the public API.
+ */
+
+#include "stusb4500_harness.h"
+
+#include "../src/stusb4500.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define HARNESS_ASSERT(cond)                                                        \
+    do {                                                                            \
+        if (!(cond)) {                                                              \
+            fprintf(stderr, "%s:%d: property violated: %s\n", __FILE__, __LINE__, #cond); \
+            abort();                                                                \
+        }                                                                           \
+    } while (0)
+
+// =============================================
+// === Fake HAL ================================
+// =============================================
+
+#define FAKE_ADDRESS        0x28
+#define FAKE_NEVER_FAIL     UINT32_MAX
+
+/** In-memory register file behind stusb4500_hal_t. */
+typedef struct
+{
+    uint8_t  regs[256];           ///< Register image
+    uint8_t  clear_on_read[256];  ///< Latched bits acknowledged by a read
+    uint32_t writes;              ///< Write transactions seen
+    uint32_t fail_write_at;       ///< Index of the write to fail
+} fake_chip_t;
+
+static fake_chip_t fake;
+
+// The driver treats a HAL return of 0 as success
+static bool _fake_read(const uint8_t dev_addr, const uint8_t reg_addr, void* const data, const uint8_t len) {
+    HARNESS_ASSERT(dev_addr == FAKE_ADDRESS);
+    if ((uint16_t)reg_addr + len > sizeof(fake.regs))
+        return true;
+
+    memcpy(data, &fake.regs[reg_addr], len);
+    for (uint16_t r = reg_addr; r < (uint16_t)reg_addr + len; r++)
+        fake.regs[r] &= (uint8_t)~fake.clear_on_read[r];
+    return false;
+}
+
+static bool _fake_write(const uint8_t dev_addr, const uint8_t reg_addr, const void* const data, const uint8_t len) {
+    HARNESS_ASSERT(dev_addr == FAKE_ADDRESS);
+    if (fake.writes++ == fake.fail_write_at || (uint16_t)reg_addr + len > sizeof(fake.regs))
+        return true;
+
+    memcpy(&fake.regs[reg_addr], data, len);
+    return false;
+}
+
+static const stusb4500_hal_t fake_hal = { .i2c_write = _fake_write, .i2c_read = _fake_read };
+
+static void _fake_reset(stusb4500_t* const dev) {
+    memset(&fake, 0, sizeof(fake));
+    fake.fail_write_at = FAKE_NEVER_FAIL;
+
+    fake.clear_on_read[STUSB4500_REG_ALERT_STATUS_1] = 0xFF;
+    fake.clear_on_read[STUSB4500_REG_PORT_STATUS_0] = STUSB4500_ATTACH_TRANS_MASK;
+    fake.clear_on_read[STUSB4500_REG_TYPEC_MONITORING_STATUS_0] =
+        STUSB4500_VBUS_READY_TRANS_MASK | STUSB4500_VBUS_VSAFE0V_TRANS_MASK | STUSB4500_VBUS_VALID_SNK_TRANS_MASK;
+    fake.clear_on_read[STUSB4500_REG_CC_HW_FAULT_STATUS_0] = STUSB4500_VPU_OVP_TRANS_MASK | STUSB4500_VPU_VALID_TRANS_MASK;
+
+    HARNESS_ASSERT(stusb4500_init(dev, &fake_hal, FAKE_ADDRESS));
+}
+
+// =============================================
+// === Input Reader ============================
+// =============================================
+
+typedef struct
+{
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+} reader_t;
+
+static uint8_t _take_u8(reader_t* const in) {
+    return (in->pos < in->size) ? in->data[in->pos++] : 0;
+}
+
+static uint16_t _take_u16(reader_t* const in) {
+    const uint16_t lo = _take_u8(in);
+    return (uint16_t)(lo | (_take_u8(in) << 8));
+}
+
+static uint32_t _take_u32(reader_t* const in) {
+    const uint32_t lo = _take_u16(in);
+    return lo | ((uint32_t)_take_u16(in) << 16);
+}
+
+// =============================================
+// === Codec Properties ========================
+// =============================================
+
+/** Decoded value equals the clamped input truncated to one step. */
+static void _check_round_trip(const uint16_t in, const uint32_t decoded, const uint16_t min, const uint16_t max, const uint16_t step) {
+    const uint16_t clamped = (in < min) ? min : (in > max) ? max : in;
+
+    HARNESS_ASSERT(decoded <= clamped);
+    HARNESS_ASSERT(clamped - decoded < step);
+}
+
+static void _check_codecs(const uint16_t mv, const uint16_t ma) {
+    const uint16_t v_field = _mv_to_reg(mv);
+    const uint16_t i_field = _ma_to_reg(ma);
+
+    // Fields are absolute and fit their 10-bit PDO slots
+    HARNESS_ASSERT(v_field >= 100 && v_field <= 400);
+    HARNESS_ASSERT(i_field >= 50 && i_field <= 500);
+    _check_round_trip(mv, (uint32_t)v_field * 50, STUSB4500_MIN_VOLTAGE_MV, STUSB4500_MAX_VOLTAGE_MV, 50);
+    _check_round_trip(ma, (uint32_t)i_field * 10, STUSB4500_MIN_CURRENT_MA, STUSB4500_MAX_CURRENT_MA, 10);
+}
+
+// =============================================
+// === Config Properties =======================
+// =============================================
+
+#define PDO_AREA_FIRST      0x85    ///< DPM_SNK_PDO1_0, per the datasheet
+#define PDO_AREA_SIZE       12      ///< Three 32-bit sink PDOs
+#define PDO_SENTINEL        0xA5    ///< Pre-fill marking bytes the driver never wrote
+
+/** Reference sink PDO decode, written against the USB PD fixed-supply layout. */
+static void _decode_sink_pdo(const uint8_t index, uint32_t* const mv, uint32_t* const ma, uint32_t* const type) {
+    const uint8_t* const b = &fake.regs[PDO_AREA_FIRST + index * 4];
+    const uint32_t pdo = (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+
+    *ma = (pdo & 0x3FFU) * 10;
+    *mv = ((pdo >> 10) & 0x3FFU) * 50;
+    *type = pdo >> 30;
+}
+
+static void _check_set_config(const stusb4500_config_t* const config, const uint32_t fail_write_at) {
+    stusb4500_t dev;
+    _fake_reset(&dev);
+    fake.fail_write_at = fail_write_at;
+    memset(&fake.regs[PDO_AREA_FIRST], PDO_SENTINEL, PDO_AREA_SIZE);
+
+    const bool valid = config->active_pdo_count >= 1 && config->active_pdo_count <= 3;
+    const uint32_t total_writes = valid ? 4U * config->active_pdo_count : 0;
+    const bool ok = stusb4500_set_config(&dev, config);
+
+    // Every write must succeed, and nothing is written after the first failure
+    const bool fails = fail_write_at < total_writes;
+    HARNESS_ASSERT(ok == (valid && !fails));
+    HARNESS_ASSERT(fake.writes == (fails ? fail_write_at + 1 : total_writes));
+
+    // Writes land in register order, so everything from the failed write on is untouched
+    const uint32_t written = fails ? fail_write_at : total_writes;
+    for (uint32_t r = written; r < PDO_AREA_SIZE; r++)
+        HARNESS_ASSERT(fake.regs[PDO_AREA_FIRST + r] == PDO_SENTINEL);
+    if (!ok)
+        return;
+
+    // Register image decodes back to the requested PDOs
+    for (uint8_t i = 0; i < config->active_pdo_count; i++) {
+        uint32_t mv = 0;
+        uint32_t ma = 0;
+        uint32_t type = 0;
+        _decode_sink_pdo(i, &mv, &ma, &type);
+
+        HARNESS_ASSERT(type == ((uint32_t)config->sink_pdos[i].type & 0x3U));
+        _check_round_trip(config->sink_pdos[i].voltage_mv, mv, STUSB4500_MIN_VOLTAGE_MV, STUSB4500_MAX_VOLTAGE_MV, 50);
+        _check_round_trip(config->sink_pdos[i].current_ma, ma, STUSB4500_MIN_CURRENT_MA, STUSB4500_MAX_CURRENT_MA, 10);
+    }
+}
+
+// =============================================
+// === Event Properties ========================
+// =============================================
+
+/** Reference decode of the burst registers, written against raw datasheet bit positions. */
+static void _model_decode(uint32_t* const level, uint32_t* const trans) {
+    const uint8_t* const r = fake.regs;
+    uint32_t l = 0;
+    uint32_t t = 0;
+
+    if (r[0x0E] & (1U << 0)) l |= STUSB4500_EVT_ATTACH;
+    if (r[0x10] & (1U << 3)) l |= STUSB4500_EVT_VBUS_READY;
+    if (r[0x0F] & (1U << 5)) l |= STUSB4500_EVT_VBUS_HIGH;
+    if (r[0x0F] & (1U << 4)) l |= STUSB4500_EVT_VBUS_LOW;
+    if (r[0x13] & (1U << 7)) l |= STUSB4500_EVT_VPU_OVP_FAULT;
+    if (r[0x13] & (1U << 4)) l |= STUSB4500_EVT_VBUS_DISCH_FAULT;
+
+    if (r[0x0D] & (1U << 0)) t |= STUSB4500_EVT_ATTACH;
+    if (r[0x0F] & (1U << 3)) t |= STUSB4500_EVT_VBUS_READY;
+    if (r[0x12] & (1U << 5)) t |= STUSB4500_EVT_VPU_OVP_FAULT;
+    if (r[0x0B] & (1U << 4)) t |= STUSB4500_EVT_CC_HW_FAULT;
+
+    *level = l;
+    *trans = t;
+}
+
+static void _check_event_decode(reader_t* const in) {
+    stusb4500_t dev;
+    _fake_reset(&dev);
+    for (uint8_t r = STUSB4500_EVT_BURST_FIRST; r <= STUSB4500_EVT_BURST_LAST; r++)
+        fake.regs[r] = _take_u8(in);
+
+    uint32_t want_level = 0;
+    uint32_t want_trans = 0;
+    _model_decode(&want_level, &want_trans);
+
+    uint8_t image[STUSB4500_EVT_BURST_LAST - STUSB4500_EVT_BURST_FIRST + 1];
+    memcpy(image, &fake.regs[STUSB4500_EVT_BURST_FIRST], sizeof(image));
+
+    // Slow path: one stusb4500_read_register() per register
+    uint8_t single[sizeof(image)];
+    for (uint8_t r = 0; r < sizeof(single); r++)
+        HARNESS_ASSERT(stusb4500_read_register(&dev, STUSB4500_EVT_BURST_FIRST + r, &single[r]));
+    HARNESS_ASSERT(memcmp(single, image, sizeof(image)) == 0);
+
+    uint32_t slow_level = 0;
+    uint32_t slow_trans = 0;
+    _decode_event_regs(single, &slow_level, &slow_trans);
+
+    // Batched path on the same image; the slow reads acknowledged its latches
+    memcpy(&fake.regs[STUSB4500_EVT_BURST_FIRST], image, sizeof(image));
+    uint32_t level = 0;
+    uint32_t trans = 0;
+    HARNESS_ASSERT(_read_event_state(&dev, &level, &trans));
+    HARNESS_ASSERT(level == slow_level && trans == slow_trans);
+    HARNESS_ASSERT(level == want_level);
+    HARNESS_ASSERT(trans == want_trans);
+    HARNESS_ASSERT((level & STUSB4500_EVT_EDGE_ONLY) == 0);
+
+    // The burst read acknowledges every latch
+    HARNESS_ASSERT(_read_event_state(&dev, &level, &trans));
+    HARNESS_ASSERT(trans == 0);
+}
+
+/** Callback recorder for the poll model. */
+typedef struct
+{
+    uint32_t calls;
+    uint32_t changed;
+    uint32_t state;
+} recorder_t;
+
+static void _record(const uint32_t changed, const uint32_t state, void* const ctx) {
+    recorder_t* const rec = (recorder_t*)ctx;
+    rec->calls++;
+    rec->changed = changed;
+    rec->state = state;
+}
+
+/** Toggle a level bit and latch its transition flag, as the chip does. */
+static void _toggle(const uint8_t reg, const uint8_t bit, const uint8_t trans_reg, const uint8_t trans_bit) {
+    fake.regs[reg] ^= bit;
+    fake.regs[trans_reg] |= trans_bit;
+}
+
+/** Mirror of the driver's coalescing window. */
+typedef struct
+{
+    uint32_t level;
+    uint32_t pending;
+    uint32_t window_start;
+    bool     window_open;
+} model_t;
+
+static void _check_event_sequence(reader_t* const in) {
+    stusb4500_t dev;
+    _fake_reset(&dev);
+    fake.regs[STUSB4500_REG_ALERT_STATUS_1_MASK] = _take_u8(in);
+
+    const uint32_t mask = _take_u8(in) & STUSB4500_EVT_ALL;
+    const uint32_t interval = _take_u16(in) % 1000;
+    uint32_t now = _take_u32(in);
+
+    recorder_t rec = { 0 };
+    if (mask == 0) {
+        HARNESS_ASSERT(!stusb4500_subscribe(&dev, mask, interval, _record, &rec));
+        return;
+    }
+
+    const uint8_t mask_before = fake.regs[STUSB4500_REG_ALERT_STATUS_1_MASK];
+    HARNESS_ASSERT(stusb4500_subscribe(&dev, mask, interval, _record, &rec));
+
+    // Only the backing alert sources are unmasked; unrelated bits are preserved
+    const uint8_t mask_after = fake.regs[STUSB4500_REG_ALERT_STATUS_1_MASK];
+    HARNESS_ASSERT((mask_after & ~STUSB4500_EVT_ALERT_BITS) == (mask_before & ~STUSB4500_EVT_ALERT_BITS));
+    HARNESS_ASSERT(((mask & STUSB4500_EVT_ATTACH) != 0) == ((mask_after & STUSB4500_PORT_STATUS_AL_M_MASK) == 0));
+    HARNESS_ASSERT(((mask & (STUSB4500_EVT_VBUS_READY | STUSB4500_EVT_VBUS_HIGH | STUSB4500_EVT_VBUS_LOW)) != 0) ==
+                   ((mask_after & STUSB4500_TYPEC_MON_STATUS_M_MASK) == 0));
+    HARNESS_ASSERT(((mask & (STUSB4500_EVT_CC_HW_FAULT | STUSB4500_EVT_VPU_OVP_FAULT | STUSB4500_EVT_VBUS_DISCH_FAULT)) != 0) ==
+                   ((mask_after & STUSB4500_CC_FAULT_AL_M_MASK) == 0));
+
+    model_t model = { 0 };
+    uint32_t trans = 0;
+    _model_decode(&model.level, &trans);
+    model.level &= mask;
+
+    for (uint8_t steps = _take_u8(in); steps > 0 && in->pos < in->size; steps--) {
+        const uint8_t levels = _take_u8(in);
+        const uint8_t pulses = _take_u8(in);
+        now += _take_u8(in);
+
+        if (levels & 0x01) _toggle(0x0E, 1U << 0, 0x0D, 1U << 0);
+        if (levels & 0x02) _toggle(0x10, 1U << 3, 0x0F, 1U << 3);
+        if (levels & 0x04) fake.regs[0x0F] ^= (1U << 5);
+        if (levels & 0x08) fake.regs[0x0F] ^= (1U << 4);
+        if (levels & 0x10) _toggle(0x13, 1U << 7, 0x12, 1U << 5);
+        if (levels & 0x20) fake.regs[0x13] ^= (1U << 4);
+
+        // Latch-only pulses model changes that reverted before the next read
+        if (pulses & 0x01) fake.regs[0x0D] |= (1U << 0);
+        if (pulses & 0x02) fake.regs[0x0F] |= (1U << 3);
+        if (pulses & 0x04) fake.regs[0x12] |= (1U << 5);
+        if (pulses & 0x08) fake.regs[0x0B] |= (1U << 4);
+        if (!(pulses & 0x80))
+            continue;
+
+        uint32_t level = 0;
+        _model_decode(&level, &trans);
+        level &= mask;
+        model.pending |= (level ^ model.level) | (trans & mask);
+        model.level = level;
+
+        bool fire = false;
+        if (!model.window_open || now - model.window_start >= interval) {
+            if (model.pending) {
+                fire = true;
+            } else {
+                model.window_open = false;
+            }
+        }
+
+        const uint32_t calls = rec.calls;
+        uint32_t next_poll = UINT32_MAX;
+        HARNESS_ASSERT(stusb4500_poll_events(&dev, now, &next_poll));
+
+        if (fire) {
+            HARNESS_ASSERT(rec.calls == calls + 1);
+            HARNESS_ASSERT(rec.changed == model.pending);
+            HARNESS_ASSERT(rec.state == (model.level & ~STUSB4500_EVT_EDGE_ONLY));
+            HARNESS_ASSERT(next_poll == 0);
+            model.pending = 0;
+            model.window_start = now;
+            model.window_open = true;
+        } else {
+            HARNESS_ASSERT(rec.calls == calls);
+            HARNESS_ASSERT(next_poll == (model.pending ? interval - (now - model.window_start) : 0));
+            HARNESS_ASSERT(next_poll <= interval);
+        }
+    }
+
+    // Held-back transitions are delivered once the advertised deadline passes
+    uint32_t next_poll = 0;
+    HARNESS_ASSERT(stusb4500_poll_events(&dev, now, &next_poll));
+    const uint32_t calls = rec.calls;
+    HARNESS_ASSERT(stusb4500_poll_events(&dev, now + next_poll, &next_poll));
+    HARNESS_ASSERT(next_poll == 0);
+    HARNESS_ASSERT(dev.events.pending == 0);
+    HARNESS_ASSERT(rec.calls <= calls + 1);
+
+    // Unsubscribing restores the mask the subscription replaced
+    HARNESS_ASSERT(stusb4500_subscribe(&dev, mask, interval, _record, &rec));
+    HARNESS_ASSERT(stusb4500_unsubscribe(&dev));
+    HARNESS_ASSERT(fake.regs[STUSB4500_REG_ALERT_STATUS_1_MASK] == mask_before);
+    HARNESS_ASSERT(dev.events.callback == NULL);
+}
+
+// =============================================
+// === Entry Points ============================
+// =============================================
+
+void harness_run(const uint8_t* const data, const size_t size)
+{
+    reader_t in = { .data = data, .size = size, .pos = 0 };
+
+    const uint16_t mv = _take_u16(&in);
+    const uint16_t ma = _take_u16(&in);
+    _check_codecs(mv, ma);
+
+    stusb4500_config_t config;
+    memset(&config, 0, sizeof(config));
+    config.active_pdo_count = _take_u8(&in) % 5;
+    for (uint8_t i = 0; i < 3; i++) {
+        config.sink_pdos[i].type = (stusb4500_pdo_type_t)(_take_u8(&in) & 0x3);
+        config.sink_pdos[i].voltage_mv = _take_u16(&in);
+        config.sink_pdos[i].current_ma = _take_u16(&in);
+    }
+    const uint8_t fail = _take_u8(&in);
+    _check_set_config(&config, (fail & 0x80) ? FAKE_NEVER_FAIL : (fail & 0x0F));
+
+    _check_event_decode(&in);
+    _check_event_sequence(&in);
+}
+
+void harness_run_codec_sweep(void)
+{
+    for (uint32_t v = 0; v <= UINT16_MAX; v++)
+        _check_codecs((uint16_t)v, (uint16_t)v);
+
+    // Fields are absolute: 5V is 100 and 500mA is 50, and exact steps encode without loss
+    HARNESS_ASSERT(_mv_to_reg(5000) == 100 && _mv_to_reg(5050) == 101 && _mv_to_reg(20000) == 400);
+    HARNESS_ASSERT(_ma_to_reg(500) == 50 && _ma_to_reg(510) == 51 && _ma_to_reg(5000) == 500);
+
+    // In-range inputs truncate down to the step below
+    HARNESS_ASSERT(_mv_to_reg(5049) == 100 && _mv_to_reg(19999) == 399);
+    HARNESS_ASSERT(_ma_to_reg(509) == 50 && _ma_to_reg(4999) == 499);
+
+    // Known PDO word: fixed 9V / 3A is 0x0002D12C
+    stusb4500_sink_pdo_t pdo = { .type = STUSB4500_PDO_FIXED_SUPPLY, .voltage_mv = 9000, .current_ma = 3000 };
+    HARNESS_ASSERT(_pack_sink_pdo(&pdo) == 0x0002D12CUL);
+}
+
+void harness_run_directed(void)
+{
+    stusb4500_t dev;
+    uint8_t value = 0;
+
+    // Arguments are validated before the handle is touched
+    _fake_reset(&dev);
+    const stusb4500_hal_t no_read = { .i2c_write = _fake_write, .i2c_read = NULL };
+    const stusb4500_hal_t no_write = { .i2c_write = NULL, .i2c_read = _fake_read };
+    HARNESS_ASSERT(!stusb4500_init(NULL, &fake_hal, FAKE_ADDRESS));
+    HARNESS_ASSERT(!stusb4500_init(&dev, NULL, FAKE_ADDRESS));
+    HARNESS_ASSERT(!stusb4500_init(&dev, &no_read, FAKE_ADDRESS));
+    HARNESS_ASSERT(!stusb4500_init(&dev, &no_write, FAKE_ADDRESS));
+
+    stusb4500_t blank;
+    memset(&blank, 0, sizeof(blank));
+    HARNESS_ASSERT(stusb4500_init(&blank, &fake_hal, FAKE_ADDRESS));
+
+    HARNESS_ASSERT(!stusb4500_read_register(NULL, STUSB4500_REG_DEVICE_ID, &value));
+    HARNESS_ASSERT(!stusb4500_read_register(&dev, STUSB4500_REG_DEVICE_ID, NULL));
+    HARNESS_ASSERT(!stusb4500_write_register(NULL, STUSB4500_REG_DEVICE_ID, 0));
+    HARNESS_ASSERT(!stusb4500_set_config(NULL, NULL));
+    HARNESS_ASSERT(!stusb4500_set_config(&dev, NULL));
+
+    fake.regs[STUSB4500_REG_DEVICE_ID] = 0x25;
+    HARNESS_ASSERT(stusb4500_read_register(&dev, STUSB4500_REG_DEVICE_ID, &value) && value == 0x25);
+
+    // Failing any single write fails the whole configuration
+    stusb4500_config_t config;
+    memset(&config, 0, sizeof(config));
+    config.active_pdo_count = 3;
+    for (uint8_t i = 0; i < 3; i++) {
+        config.sink_pdos[i].voltage_mv = (uint16_t)(5000 + 5000 * i);
+        config.sink_pdos[i].current_ma = 1500;
+    }
+    for (uint32_t fail = 0; fail < 12; fail++)
+        _check_set_config(&config, fail);
+    _check_set_config(&config, FAKE_NEVER_FAIL);
+
+    recorder_t rec = { 0 };
+
+    // Detach and reattach between polls is reported through ATTACH_TRANS
+    _fake_reset(&dev);
+    fake.regs[STUSB4500_REG_PORT_STATUS_1] = STUSB4500_ATTACH_STATE_MASK;
+    HARNESS_ASSERT(stusb4500_subscribe(&dev, STUSB4500_EVT_ATTACH, 100, _record, &rec));
+    fake.regs[STUSB4500_REG_PORT_STATUS_0] |= STUSB4500_ATTACH_TRANS_MASK;
+    HARNESS_ASSERT(stusb4500_poll_events(&dev, 10, NULL));
+    HARNESS_ASSERT(rec.calls == 1 && rec.changed == STUSB4500_EVT_ATTACH && rec.state == STUSB4500_EVT_ATTACH);
+
+    // A second bounce inside the window is held back and its deadline reported
+    uint32_t next_poll = 0;
+    fake.regs[STUSB4500_REG_PORT_STATUS_0] |= STUSB4500_ATTACH_TRANS_MASK;
+    HARNESS_ASSERT(stusb4500_poll_events(&dev, 40, &next_poll));
+    HARNESS_ASSERT(rec.calls == 1 && next_poll == 70);
+    HARNESS_ASSERT(stusb4500_poll_events(&dev, 40 + next_poll, &next_poll));
+    HARNESS_ASSERT(rec.calls == 2 && next_poll == 0);
+
+    // A latched CC fault is one edge, never a level
+    rec.calls = 0;
+    _fake_reset(&dev);
+    fake.regs[STUSB4500_REG_ALERT_STATUS_1] = STUSB4500_CC_HW_FAULT_AL_MASK;
+    HARNESS_ASSERT(stusb4500_subscribe(&dev, STUSB4500_EVT_CC_HW_FAULT, 0, _record, &rec));
+    HARNESS_ASSERT(stusb4500_poll_events(&dev, 0, NULL));
+    HARNESS_ASSERT(rec.calls == 0);
+
+    fake.regs[STUSB4500_REG_ALERT_STATUS_1] = STUSB4500_CC_HW_FAULT_AL_MASK;
+    HARNESS_ASSERT(stusb4500_poll_events(&dev, 1, NULL));
+    HARNESS_ASSERT(rec.calls == 1 && rec.changed == STUSB4500_EVT_CC_HW_FAULT && rec.state == 0);
+    HARNESS_ASSERT(stusb4500_poll_events(&dev, 2, NULL));
+    HARNESS_ASSERT(rec.calls == 1);
+
+    // A failed restore keeps the subscription so unsubscribe can be retried
+    fake.fail_write_at = fake.writes;
+    HARNESS_ASSERT(!stusb4500_unsubscribe(&dev));
+    HARNESS_ASSERT(dev.events.callback == _record);
+    HARNESS_ASSERT(stusb4500_unsubscribe(&dev));
+    HARNESS_ASSERT(fake.regs[STUSB4500_REG_ALERT_STATUS_1_MASK] == 0);
+}
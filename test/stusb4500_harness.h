@@ -0,0 +1,44 @@
+/**
+ * @file stusb4500_harness.h
+ * @brief Host-side fake HAL and property checks shared by the property test and fuzzer.
+ * @version 0.1
+ * @date 2026-10-19
+ */
+
+#ifndef STUSB4500_HARNESS_H
+#define STUSB4500_HARNESS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Run every property check against one input buffer.
+ *
+ * The buffer is consumed as codec inputs, a configuration, a register image
+ * and a sequence of register changes and polls. Violations abort().
+ *
+ * @param data Input bytes (any length, missing bytes read as zero).
+ * @param size Number of input bytes.
+ */
+void harness_run(const uint8_t* const data, const size_t size);
+
+/**
+ * @brief Run the directed edge-case checks (NULL arguments, write failures, latched alerts).
+ */
+void harness_run_directed(void);
+
+/**
+ * @brief Sweep every 16-bit input through the voltage and current codecs.
+ */
+void harness_run_codec_sweep(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STUSB4500_HARNESS_H */